@@ -1,8 +1,17 @@
 #include "HybridNitroBuffer.hpp"
+#include "NitroBufferEncoding.hpp"
+#include "NitroBufferRange.hpp"
+#include "NitroBufferSimd.hpp"
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <climits>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace margelo::nitro::buffer {
@@ -14,15 +23,12 @@ static inline bool is_base64(unsigned char c) {
   return (isalnum(c) || (c == '+') || (c == '/'));
 }
 
-std::string base64_encode(const unsigned char *bytes_to_encode,
-                          unsigned int in_len) {
-  std::string ret;
-  size_t output_len = 4 * ((in_len + 2) / 3);
-  ret.resize(output_len);
-
+// Encode `in_len` bytes into `out`, which must have room for
+// 4 * ((in_len + 2) / 3) characters. Returns the number of characters written.
+static size_t base64_encode_into(const unsigned char *bytes_to_encode,
+                                 size_t in_len, char *out) {
   size_t i = 0;
   size_t j = 0;
-  char *out = &ret[0];
 
   while (i + 2 < in_len) {
     uint32_t octet_a = bytes_to_encode[i++];
@@ -58,6 +64,16 @@ std::string base64_encode(const unsigned char *bytes_to_encode,
     }
   }
 
+  return j;
+}
+
+std::string base64_encode(const unsigned char *bytes_to_encode,
+                          unsigned int in_len) {
+  std::string ret;
+  size_t output_len = 4 * ((in_len + 2) / 3);
+  ret.resize(output_len);
+  if (output_len > 0)
+    base64_encode_into(bytes_to_encode, in_len, &ret[0]);
   return ret;
 }
 // Reverse lookup table for base64 decoding (255 = invalid)
@@ -417,6 +433,32 @@ static std::string decodeAscii(const uint8_t *data, size_t len) {
   return result;
 }
 
+std::string decodeBytes(const uint8_t *data, size_t len,
+                        const std::string &encoding) {
+  if (encoding == "utf8" || encoding == "utf-8") {
+    // WHATWG-compliant UTF-8 decoding with replacement character for invalid
+    // sequences
+    return decodeUtf8WithReplacement(data, len);
+  } else if (encoding == "latin1" || encoding == "binary") {
+    // Each byte maps to Unicode code point 0x00-0xFF
+    return decodeLatin1(data, len);
+  } else if (encoding == "ascii") {
+    // ASCII with replacement for non-ASCII bytes
+    return decodeAscii(data, len);
+  } else if (encoding == "hex") {
+    std::string hex;
+    hex.resize(len * 2);
+    if (len > 0)
+      simd::hexEncode(data, len, reinterpret_cast<uint8_t *>(&hex[0]));
+    return hex;
+  } else if (encoding == "base64") {
+    return base64_encode(data, (unsigned int)len);
+  }
+
+  // Default: UTF-8 with replacement
+  return decodeUtf8WithReplacement(data, len);
+}
+
 std::string
 HybridNitroBuffer::decode(const std::shared_ptr<ArrayBuffer> &buffer,
                           double offset, double length,
@@ -431,32 +473,840 @@ HybridNitroBuffer::decode(const std::shared_ptr<ArrayBuffer> &buffer,
   size_t available = bufferSize - start;
   size_t actualRead = std::min(available, count);
 
-  if (encoding == "utf8" || encoding == "utf-8") {
-    // WHATWG-compliant UTF-8 decoding with replacement character for invalid
-    // sequences
-    return decodeUtf8WithReplacement(data + start, actualRead);
-  } else if (encoding == "latin1" || encoding == "binary") {
-    // Each byte maps to Unicode code point 0x00-0xFF
-    return decodeLatin1(data + start, actualRead);
-  } else if (encoding == "ascii") {
-    // ASCII with replacement for non-ASCII bytes
-    return decodeAscii(data + start, actualRead);
-  } else if (encoding == "hex") {
-    std::string hex;
-    hex.reserve(actualRead * 2);
-    const char *hexDigits = "0123456789abcdef";
-    for (size_t i = 0; i < actualRead; i++) {
-      unsigned char c = data[start + i];
-      hex.push_back(hexDigits[c >> 4]);
-      hex.push_back(hexDigits[c & 0x0F]);
+  return decodeBytes(data + start, actualRead, encoding);
+}
+
+// ============== Transcode ==============
+// Direct byte-to-byte conversion between the Unicode-capable encodings, so
+// `transcode` never has to materialize an intermediate JS string.
+// Replacement semantics follow Node.js (ICU): malformed input becomes U+FFFD
+// in UTF-8/UTF-16LE output, and characters that cannot be represented in
+// latin1/ascii output become '?'.
+
+enum class TranscodeEncoding { Utf8, Utf16le, Latin1, Ascii, Unsupported };
+
+static TranscodeEncoding parseTranscodeEncoding(const std::string &encoding) {
+  if (encoding == "utf8" || encoding == "utf-8")
+    return TranscodeEncoding::Utf8;
+  if (encoding == "utf16le" || encoding == "utf-16le" || encoding == "ucs2" ||
+      encoding == "ucs-2")
+    return TranscodeEncoding::Utf16le;
+  if (encoding == "latin1" || encoding == "binary")
+    return TranscodeEncoding::Latin1;
+  if (encoding == "ascii")
+    return TranscodeEncoding::Ascii;
+  return TranscodeEncoding::Unsupported;
+}
+
+static const uint32_t REPLACEMENT_CODE_POINT = 0xFFFD;
+
+// Output side of a transcode. With Measure = true nothing is written and
+// `pos` only accumulates the output size, which lets us allocate an exactly
+// sized ArrayBuffer before the real pass.
+template <TranscodeEncoding To, bool Measure> struct TranscodeSink {
+  uint8_t *out = nullptr;
+  size_t pos = 0;
+
+  // Run of ASCII bytes from a single-byte source (utf8/latin1/ascii)
+  inline void asciiBytes(const uint8_t *src, size_t n) {
+    if constexpr (To == TranscodeEncoding::Utf16le) {
+      if constexpr (!Measure)
+        simd::widenBytes(src, n, out + pos);
+      pos += n * 2;
+    } else {
+      if constexpr (!Measure)
+        memcpy(out + pos, src, n);
+      pos += n;
     }
-    return hex;
-  } else if (encoding == "base64") {
-    return base64_encode(data + start, (unsigned int)actualRead);
   }
 
-  // Default: UTF-8 with replacement
-  return decodeUtf8WithReplacement(data + start, actualRead);
+  // Run of ASCII code units from a UTF-16LE source
+  inline void asciiUnits(const uint8_t *src, size_t units) {
+    if constexpr (To == TranscodeEncoding::Utf16le) {
+      if constexpr (!Measure)
+        memcpy(out + pos, src, units * 2);
+      pos += units * 2;
+    } else {
+      if constexpr (!Measure)
+        simd::narrowUnits(src, units, out + pos);
+      pos += units;
+    }
+  }
+
+  inline void put(uint8_t byte) {
+    if constexpr (!Measure)
+      out[pos] = byte;
+    pos++;
+  }
+
+  inline void codePoint(uint32_t cp) {
+    if constexpr (To == TranscodeEncoding::Utf8) {
+      if (cp < 0x80) {
+        put(static_cast<uint8_t>(cp));
+      } else if (cp < 0x800) {
+        put(static_cast<uint8_t>(0xC0 | (cp >> 6)));
+        put(static_cast<uint8_t>(0x80 | (cp & 0x3F)));
+      } else if (cp < 0x10000) {
+        put(static_cast<uint8_t>(0xE0 | (cp >> 12)));
+        put(static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F)));
+        put(static_cast<uint8_t>(0x80 | (cp & 0x3F)));
+      } else {
+        put(static_cast<uint8_t>(0xF0 | (cp >> 18)));
+        put(static_cast<uint8_t>(0x80 | ((cp >> 12) & 0x3F)));
+        put(static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F)));
+        put(static_cast<uint8_t>(0x80 | (cp & 0x3F)));
+      }
+    } else if constexpr (To == TranscodeEncoding::Utf16le) {
+      if (cp >= 0x10000) {
+        uint32_t v = cp - 0x10000;
+        uint32_t high = 0xD800 | (v >> 10);
+        uint32_t low = 0xDC00 | (v & 0x3FF);
+        put(static_cast<uint8_t>(high & 0xFF));
+        put(static_cast<uint8_t>(high >> 8));
+        put(static_cast<uint8_t>(low & 0xFF));
+        put(static_cast<uint8_t>(low >> 8));
+      } else {
+        put(static_cast<uint8_t>(cp & 0xFF));
+        put(static_cast<uint8_t>(cp >> 8));
+      }
+    } else if constexpr (To == TranscodeEncoding::Latin1) {
+      put(cp <= 0xFF ? static_cast<uint8_t>(cp) : '?');
+    } else {
+      put(cp <= 0x7F ? static_cast<uint8_t>(cp) : '?');
+    }
+  }
+};
+
+// UTF-8 source. Invalid sequences are replaced using the "maximal subpart"
+// rule (one U+FFFD per maximal invalid prefix), as ICU and WHATWG do.
+template <class Sink>
+static void transcodeFromUtf8(const uint8_t *data, size_t len, Sink &sink) {
+  size_t i = 0;
+  while (i < len) {
+    if (data[i] < 0x80) {
+      size_t run = simd::asciiPrefixLength(data + i, len - i);
+      sink.asciiBytes(data + i, run);
+      i += run;
+      continue;
+    }
+
+    uint8_t byte1 = data[i];
+    size_t needed;
+    uint32_t cp;
+    uint8_t lower = 0x80;
+    uint8_t upper = 0xBF;
+    if (byte1 >= 0xC2 && byte1 <= 0xDF) {
+      needed = 1;
+      cp = byte1 & 0x1F;
+    } else if (byte1 >= 0xE0 && byte1 <= 0xEF) {
+      needed = 2;
+      cp = byte1 & 0x0F;
+      if (byte1 == 0xE0)
+        lower = 0xA0; // Overlong
+      if (byte1 == 0xED)
+        upper = 0x9F; // Surrogates
+    } else if (byte1 >= 0xF0 && byte1 <= 0xF4) {
+      needed = 3;
+      cp = byte1 & 0x07;
+      if (byte1 == 0xF0)
+        lower = 0x90; // Overlong
+      if (byte1 == 0xF4)
+        upper = 0x8F; // > U+10FFFF
+    } else {
+      sink.codePoint(REPLACEMENT_CODE_POINT);
+      i++;
+      continue;
+    }
+
+    size_t j = i + 1;
+    bool valid = true;
+    for (size_t k = 0; k < needed; k++, j++) {
+      if (j >= len || data[j] < lower || data[j] > upper) {
+        valid = false;
+        break;
+      }
+      cp = (cp << 6) | (data[j] & 0x3F);
+      lower = 0x80;
+      upper = 0xBF;
+    }
+    // On failure the offending byte is not consumed; it starts the next
+    // sequence.
+    sink.codePoint(valid ? cp : REPLACEMENT_CODE_POINT);
+    i = j;
+  }
+}
+
+template <class Sink>
+static void transcodeFromLatin1(const uint8_t *data, size_t len, Sink &sink) {
+  size_t i = 0;
+  while (i < len) {
+    size_t run = simd::asciiPrefixLength(data + i, len - i);
+    sink.asciiBytes(data + i, run);
+    i += run;
+    if (i < len) {
+      sink.codePoint(data[i]);
+      i++;
+    }
+  }
+}
+
+template <class Sink>
+static void transcodeFromAscii(const uint8_t *data, size_t len, Sink &sink) {
+  size_t i = 0;
+  while (i < len) {
+    size_t run = simd::asciiPrefixLength(data + i, len - i);
+    sink.asciiBytes(data + i, run);
+    i += run;
+    if (i < len) {
+      sink.codePoint(REPLACEMENT_CODE_POINT);
+      i++;
+    }
+  }
+}
+
+// UTF-16LE source. A trailing odd byte is ignored and unpaired surrogates
+// become U+FFFD.
+template <class Sink>
+static void transcodeFromUtf16le(const uint8_t *data, size_t len, Sink &sink) {
+  size_t units = len / 2;
+  size_t i = 0;
+  while (i < units) {
+    size_t run = simd::asciiUnitPrefixLength(data + i * 2, units - i);
+    sink.asciiUnits(data + i * 2, run);
+    i += run;
+    if (i >= units)
+      break;
+
+    uint32_t unit = data[i * 2] | (data[i * 2 + 1] << 8);
+    i++;
+    if (unit >= 0xD800 && unit <= 0xDBFF && i < units) {
+      uint32_t next = data[i * 2] | (data[i * 2 + 1] << 8);
+      if (next >= 0xDC00 && next <= 0xDFFF) {
+        sink.codePoint(0x10000 + ((unit - 0xD800) << 10) + (next - 0xDC00));
+        i++;
+        continue;
+      }
+    }
+    if (unit >= 0xD800 && unit <= 0xDFFF) {
+      sink.codePoint(REPLACEMENT_CODE_POINT);
+    } else {
+      sink.codePoint(unit);
+    }
+  }
+}
+
+template <class Sink>
+static void transcodeFrom(TranscodeEncoding from, const uint8_t *data,
+                          size_t len, Sink &sink) {
+  switch (from) {
+  case TranscodeEncoding::Utf8:
+    transcodeFromUtf8(data, len, sink);
+    break;
+  case TranscodeEncoding::Utf16le:
+    transcodeFromUtf16le(data, len, sink);
+    break;
+  case TranscodeEncoding::Latin1:
+    transcodeFromLatin1(data, len, sink);
+    break;
+  case TranscodeEncoding::Ascii:
+    transcodeFromAscii(data, len, sink);
+    break;
+  case TranscodeEncoding::Unsupported:
+    break;
+  }
+}
+
+template <TranscodeEncoding To>
+static std::shared_ptr<ArrayBuffer>
+transcodeTo(TranscodeEncoding from, const uint8_t *data, size_t len) {
+  // Output size is fixed when every input byte maps to exactly one code
+  // point (latin1/ascii sources); otherwise measure with a counting pass
+  // (cheap for ASCII-heavy input thanks to the SIMD fast paths). UTF-16LE
+  // sources are always measured: a surrogate pair is two code units but
+  // becomes a single '?' in latin1/ascii.
+  size_t outputLen;
+  bool fromSingleByte =
+      from == TranscodeEncoding::Latin1 || from == TranscodeEncoding::Ascii;
+  if (To == TranscodeEncoding::Utf16le && fromSingleByte) {
+    outputLen = len * 2;
+  } else if (To != TranscodeEncoding::Utf8 &&
+             To != TranscodeEncoding::Utf16le && fromSingleByte) {
+    outputLen = len;
+  } else {
+    TranscodeSink<To, true> counter;
+    transcodeFrom(from, data, len, counter);
+    outputLen = counter.pos;
+  }
+
+  auto result = ArrayBuffer::allocate(outputLen);
+  TranscodeSink<To, false> writer;
+  writer.out = result->data();
+  transcodeFrom(from, data, len, writer);
+  // Every byte must be written: ArrayBuffer::allocate does not zero memory
+  assert(writer.pos == outputLen);
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer>
+HybridNitroBuffer::transcode(const std::shared_ptr<ArrayBuffer> &source,
+                             double sourceOffset, double sourceLength,
+                             const std::string &fromEncoding,
+                             const std::string &toEncoding) {
+  TranscodeEncoding from = parseTranscodeEncoding(fromEncoding);
+  TranscodeEncoding to = parseTranscodeEncoding(toEncoding);
+  if (from == TranscodeEncoding::Unsupported ||
+      to == TranscodeEncoding::Unsupported) {
+    throw std::invalid_argument("Unable to transcode Buffer from \"" +
+                                fromEncoding + "\" to \"" + toEncoding +
+                                "\"");
+  }
+
+  uint8_t *data = nullptr;
+  size_t len = 0;
+  clampRange(source, sourceOffset, sourceLength, data, len);
+
+  // Identity conversions of fixed-width encodings are a plain copy
+  if (from == to && (from == TranscodeEncoding::Latin1 ||
+                     from == TranscodeEncoding::Utf16le)) {
+    size_t outputLen = from == TranscodeEncoding::Utf16le ? len & ~size_t(1)
+                                                          : len;
+    return ArrayBuffer::copy(data, outputLen);
+  }
+  // Valid UTF-8 passes through untouched
+  if (from == TranscodeEncoding::Utf8 && to == TranscodeEncoding::Utf8 &&
+      isValidUtf8(data, len)) {
+    return ArrayBuffer::copy(data, len);
+  }
+
+  switch (to) {
+  case TranscodeEncoding::Utf8:
+    return transcodeTo<TranscodeEncoding::Utf8>(from, data, len);
+  case TranscodeEncoding::Utf16le:
+    return transcodeTo<TranscodeEncoding::Utf16le>(from, data, len);
+  case TranscodeEncoding::Latin1:
+    return transcodeTo<TranscodeEncoding::Latin1>(from, data, len);
+  default:
+    return transcodeTo<TranscodeEncoding::Ascii>(from, data, len);
+  }
+}
+
+// ============== Binary-to-binary codecs ==============
+// base64/hex between two ArrayBuffer ranges, without materializing a string.
+
+static inline bool isBase64Whitespace(uint8_t c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' ||
+         c == '\v';
+}
+
+// Like base64_decode_table, but also accepts the URL-safe alphabet
+static inline uint8_t base64Value(uint8_t c) {
+  uint8_t v = base64_decode_table[c];
+  if (v != 255)
+    return v;
+  if (c == '-')
+    return 62;
+  if (c == '_')
+    return 63;
+  return 255;
+}
+
+// Decode base64 text into `out`, truncating the output at `outCap` bytes.
+// Returns the number of bytes written, or -1 if the input contains a
+// character outside the alphabet. The whole input is validated even when
+// the output is truncated. In lenient mode ASCII whitespace (MIME line
+// breaks) is skipped.
+static double base64DecodeRange(const uint8_t *in, size_t inLen, uint8_t *out,
+                                size_t outCap, bool lenient) {
+  size_t i = 0;
+  size_t j = 0; // Bytes produced; only the first `outCap` are stored
+  uint32_t quad = 0;
+  size_t pending = 0; // Characters accumulated in `quad`
+
+  while (i < inLen) {
+    // Fast path: whole groups of four standard-alphabet characters
+    if (pending == 0) {
+      while (i + 4 <= inLen && j + 3 <= outCap) {
+        uint8_t a = base64_decode_table[in[i]];
+        uint8_t b = base64_decode_table[in[i + 1]];
+        uint8_t c = base64_decode_table[in[i + 2]];
+        uint8_t d = base64_decode_table[in[i + 3]];
+        if ((a | b | c | d) & 0x80)
+          break;
+        uint32_t triple = (a << 18) | (b << 12) | (c << 6) | d;
+        out[j] = static_cast<uint8_t>(triple >> 16);
+        out[j + 1] = static_cast<uint8_t>(triple >> 8);
+        out[j + 2] = static_cast<uint8_t>(triple);
+        i += 4;
+        j += 3;
+      }
+      if (i >= inLen)
+        break;
+    }
+
+    uint8_t c = in[i++];
+    uint8_t v = base64Value(c);
+    if (v != 255) {
+      quad = (quad << 6) | v;
+      if (++pending == 4) {
+        for (int shift = 16; shift >= 0; shift -= 8, j++) {
+          if (j < outCap)
+            out[j] = static_cast<uint8_t>(quad >> shift);
+        }
+        quad = 0;
+        pending = 0;
+      }
+    } else if (c == '=') {
+      // Padding ends the data; only more padding (or whitespace) may follow
+      for (; i < inLen; i++) {
+        if (in[i] != '=' && !(lenient && isBase64Whitespace(in[i])))
+          return -1;
+      }
+      break;
+    } else if (lenient && isBase64Whitespace(c)) {
+      continue;
+    } else {
+      return -1;
+    }
+  }
+
+  // Flush a partial group: 2 chars -> 1 byte, 3 chars -> 2 bytes
+  if (pending == 1 && !lenient)
+    return -1;
+  if (pending >= 2) {
+    quad <<= 6 * (4 - pending);
+    for (size_t k = 0; k < pending - 1; k++, j++) {
+      if (j < outCap)
+        out[j] = static_cast<uint8_t>(quad >> (16 - 8 * k));
+    }
+  }
+  return static_cast<double>(std::min(j, outCap));
+}
+
+// Reverse lookup table for hex digits (255 = invalid)
+static const std::array<uint8_t, 256> hex_decode_table = [] {
+  std::array<uint8_t, 256> table{};
+  table.fill(255);
+  for (int i = 0; i < 10; i++)
+    table['0' + i] = static_cast<uint8_t>(i);
+  for (int i = 0; i < 6; i++) {
+    table['a' + i] = static_cast<uint8_t>(10 + i);
+    table['A' + i] = static_cast<uint8_t>(10 + i);
+  }
+  return table;
+}();
+
+// Decode hex text into `out`. Same return convention as base64DecodeRange;
+// a trailing unpaired digit is dropped, as Node.js does.
+static double hexDecodeRange(const uint8_t *in, size_t inLen, uint8_t *out,
+                             size_t outCap, bool lenient) {
+  size_t i = 0;
+  size_t j = 0; // Bytes produced; only the first `outCap` are stored
+  int high = -1; // Pending high nibble
+
+  while (i < inLen) {
+    // Fast path: consecutive digit pairs
+    if (high < 0) {
+      while (i + 2 <= inLen && j < outCap) {
+        uint8_t a = hex_decode_table[in[i]];
+        uint8_t b = hex_decode_table[in[i + 1]];
+        if ((a | b) & 0x80)
+          break;
+        out[j++] = static_cast<uint8_t>((a << 4) | b);
+        i += 2;
+      }
+      if (i >= inLen)
+        break;
+    }
+
+    uint8_t c = in[i++];
+    uint8_t v = hex_decode_table[c];
+    if (v != 255) {
+      if (high < 0) {
+        high = v;
+      } else {
+        if (j < outCap)
+          out[j] = static_cast<uint8_t>((high << 4) | v);
+        j++;
+        high = -1;
+      }
+    } else if (lenient && isBase64Whitespace(c)) {
+      continue;
+    } else {
+      return -1;
+    }
+  }
+  return static_cast<double>(std::min(j, outCap));
+}
+
+double HybridNitroBuffer::base64EncodeInto(
+    const std::shared_ptr<ArrayBuffer> &source, double sourceOffset,
+    double sourceLength, const std::shared_ptr<ArrayBuffer> &target,
+    double targetOffset, double targetLength) {
+  uint8_t *in = nullptr;
+  size_t inLen = 0;
+  uint8_t *out = nullptr;
+  size_t outCap = 0;
+  clampRange(source, sourceOffset, sourceLength, in, inLen);
+  clampRange(target, targetOffset, targetLength, out, outCap);
+
+  // Only encode as many whole input groups as fit in the target
+  size_t maxInput = (outCap / 4) * 3;
+  if (inLen > maxInput)
+    inLen = maxInput;
+  if (inLen == 0)
+    return 0;
+  return static_cast<double>(
+      base64_encode_into(in, inLen, reinterpret_cast<char *>(out)));
+}
+
+double HybridNitroBuffer::base64DecodeInto(
+    const std::shared_ptr<ArrayBuffer> &source, double sourceOffset,
+    double sourceLength, const std::shared_ptr<ArrayBuffer> &target,
+    double targetOffset, double targetLength, bool lenient) {
+  uint8_t *in = nullptr;
+  size_t inLen = 0;
+  uint8_t *out = nullptr;
+  size_t outCap = 0;
+  clampRange(source, sourceOffset, sourceLength, in, inLen);
+  clampRange(target, targetOffset, targetLength, out, outCap);
+  return base64DecodeRange(in, inLen, out, outCap, lenient);
+}
+
+double HybridNitroBuffer::hexEncodeInto(
+    const std::shared_ptr<ArrayBuffer> &source, double sourceOffset,
+    double sourceLength, const std::shared_ptr<ArrayBuffer> &target,
+    double targetOffset, double targetLength) {
+  uint8_t *in = nullptr;
+  size_t inLen = 0;
+  uint8_t *out = nullptr;
+  size_t outCap = 0;
+  clampRange(source, sourceOffset, sourceLength, in, inLen);
+  clampRange(target, targetOffset, targetLength, out, outCap);
+
+  if (inLen > outCap / 2)
+    inLen = outCap / 2;
+  if (inLen == 0)
+    return 0;
+  simd::hexEncode(in, inLen, out);
+  return static_cast<double>(inLen * 2);
+}
+
+double HybridNitroBuffer::hexDecodeInto(
+    const std::shared_ptr<ArrayBuffer> &source, double sourceOffset,
+    double sourceLength, const std::shared_ptr<ArrayBuffer> &target,
+    double targetOffset, double targetLength, bool lenient) {
+  uint8_t *in = nullptr;
+  size_t inLen = 0;
+  uint8_t *out = nullptr;
+  size_t outCap = 0;
+  clampRange(source, sourceOffset, sourceLength, in, inLen);
+  clampRange(target, targetOffset, targetLength, out, outCap);
+  return hexDecodeRange(in, inLen, out, outCap, lenient);
+}
+
+// ============== Varint (LEB128) codec ==============
+// Bulk protobuf-style varints. Values are exchanged with JS through
+// Float64Array or BigInt64Array/BigUint64Array memory (8 bytes per value).
+// Kinds follow protobuf naming: "uint64" (unsigned), "int64" (two's
+// complement, negative values take 10 bytes) and "sint64" (zigzag).
+// A truncated trailing varint ends decoding early; a malformed one (more
+// than 10 bytes, or overflowing 64 bits) throws.
+
+enum class VarintKind { Uint64, Int64, Sint64 };
+
+static VarintKind parseVarintKind(const std::string &kind) {
+  if (kind == "uint64" || kind == "uint32")
+    return VarintKind::Uint64;
+  if (kind == "int64" || kind == "int32")
+    return VarintKind::Int64;
+  if (kind == "sint64" || kind == "sint32")
+    return VarintKind::Sint64;
+  throw std::invalid_argument("Unknown varint kind \"" + kind + "\"");
+}
+
+static inline uint64_t zigzagEncode(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+static inline int64_t zigzagDecode(uint64_t value) {
+  return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+// Store a decoded varint as a double or a 64-bit integer
+static inline void storeVarint(uint64_t raw, VarintKind kind, bool bigint,
+                               uint8_t *dst) {
+  if (bigint) {
+    int64_t v = kind == VarintKind::Sint64 ? zigzagDecode(raw)
+                                           : static_cast<int64_t>(raw);
+    memcpy(dst, &v, 8);
+    return;
+  }
+  double v;
+  if (kind == VarintKind::Uint64) {
+    v = static_cast<double>(raw);
+  } else if (kind == VarintKind::Int64) {
+    v = static_cast<double>(static_cast<int64_t>(raw));
+  } else {
+    v = static_cast<double>(zigzagDecode(raw));
+  }
+  memcpy(dst, &v, 8);
+}
+
+// Load a value to encode, saturating out-of-range doubles instead of
+// invoking undefined float -> integer conversions.
+static inline uint64_t loadVarint(const uint8_t *src, VarintKind kind,
+                                  bool bigint) {
+  int64_t signedValue;
+  if (bigint) {
+    memcpy(&signedValue, src, 8);
+  } else {
+    double d;
+    memcpy(&d, src, 8);
+    if (std::isnan(d)) {
+      signedValue = 0;
+    } else if (kind == VarintKind::Uint64 && d >= 9223372036854775808.0) {
+      return d >= 18446744073709551616.0 ? UINT64_MAX
+                                         : static_cast<uint64_t>(d);
+    } else if (d >= 9223372036854775808.0) {
+      signedValue = INT64_MAX;
+    } else if (d < -9223372036854775808.0) {
+      signedValue = INT64_MIN;
+    } else {
+      signedValue = static_cast<int64_t>(d);
+    }
+  }
+  return kind == VarintKind::Sint64 ? zigzagEncode(signedValue)
+                                    : static_cast<uint64_t>(signedValue);
+}
+
+// Decode one varint of up to 8 bytes from a little-endian word without
+// per-byte branches: the first clear continuation bit gives the length,
+// then the 7-bit groups are compacted with shifts.
+// Returns the length, or 0 if the varint is longer than 8 bytes.
+static inline size_t decodeVarintWord(uint64_t word, uint64_t &value) {
+  uint64_t stops = ~word & 0x8080808080808080ULL;
+  if (stops == 0)
+    return 0;
+  size_t len = (__builtin_ctzll(stops) >> 3) + 1;
+  if (len < 8)
+    word &= (1ULL << (len * 8)) - 1;
+  value = (word & 0x7FULL) | ((word & 0x7F00ULL) >> 1) |
+          ((word & 0x7F0000ULL) >> 2) | ((word & 0x7F000000ULL) >> 3) |
+          ((word & 0x7F00000000ULL) >> 4) | ((word & 0x7F0000000000ULL) >> 5) |
+          ((word & 0x7F000000000000ULL) >> 6) |
+          ((word & 0x7F00000000000000ULL) >> 7);
+  return len;
+}
+
+// Returned by decodeVarintSlow for input that can never be a valid varint
+static const size_t VARINT_MALFORMED = SIZE_MAX;
+
+// Byte-at-a-time decode for the tail of the range and 9-10 byte varints.
+// Returns the length, 0 if the varint is truncated by the end of the range,
+// or VARINT_MALFORMED if it is longer than 10 bytes or its 10th byte carries
+// bits beyond 64.
+static inline size_t decodeVarintSlow(const uint8_t *data, size_t len,
+                                      uint64_t &value) {
+  uint64_t result = 0;
+  size_t limit = std::min(len, static_cast<size_t>(10));
+  for (size_t i = 0; i < limit; i++) {
+    if (i == 9 && data[i] > 0x01)
+      return VARINT_MALFORMED;
+    result |= static_cast<uint64_t>(data[i] & 0x7F) << (7 * i);
+    if (data[i] < 0x80) {
+      value = result;
+      return i + 1;
+    }
+  }
+  return len >= 10 ? VARINT_MALFORMED : 0;
+}
+
+VarintResult HybridNitroBuffer::decodeVarints(
+    const std::shared_ptr<ArrayBuffer> &source, double sourceOffset,
+    double sourceLength, const std::shared_ptr<ArrayBuffer> &target,
+    double targetOffset, double targetLength, const std::string &kind,
+    bool bigint) {
+  VarintKind varintKind = parseVarintKind(kind);
+  uint8_t *in = nullptr;
+  size_t inLen = 0;
+  uint8_t *out = nullptr;
+  size_t outCap = 0;
+  clampRange(source, sourceOffset, sourceLength, in, inLen);
+  clampRange(target, targetOffset, targetLength, out, outCap);
+
+  size_t maxCount = outCap / 8;
+  size_t count = 0;
+  size_t i = 0;
+  while (count < maxCount && i < inLen) {
+    // Runs of single-byte varints (values < 128) are common in packed
+    // fields; find them with the SIMD ASCII scan and widen in bulk.
+    if (i + 1 < inLen && (in[i] | in[i + 1]) < 0x80) {
+      size_t run = simd::asciiPrefixLength(in + i, inLen - i);
+      run = std::min(run, maxCount - count);
+      for (size_t k = 0; k < run; k++) {
+        storeVarint(in[i + k], varintKind, bigint, out + (count + k) * 8);
+      }
+      i += run;
+      count += run;
+      if (count >= maxCount || i >= inLen)
+        break;
+    }
+
+    uint64_t value = 0;
+    size_t len = 0;
+    if (i + 8 <= inLen) {
+      uint64_t word;
+      memcpy(&word, in + i, 8);
+      len = decodeVarintWord(word, value);
+    }
+    if (len == 0) {
+      len = decodeVarintSlow(in + i, inLen - i, value);
+      if (len == 0)
+        break; // Truncated: stop before this varint, more data may follow
+      if (len == VARINT_MALFORMED)
+        throw std::invalid_argument("Malformed varint at byte offset " +
+                                    std::to_string(i));
+    }
+    storeVarint(value, varintKind, bigint, out + count * 8);
+    i += len;
+    count++;
+  }
+  return VarintResult(static_cast<double>(count), static_cast<double>(i));
+}
+
+VarintResult HybridNitroBuffer::encodeVarints(
+    const std::shared_ptr<ArrayBuffer> &source, double sourceOffset,
+    double sourceLength, const std::shared_ptr<ArrayBuffer> &target,
+    double targetOffset, double targetLength, const std::string &kind,
+    bool bigint) {
+  VarintKind varintKind = parseVarintKind(kind);
+  uint8_t *in = nullptr;
+  size_t inLen = 0;
+  uint8_t *out = nullptr;
+  size_t outCap = 0;
+  clampRange(source, sourceOffset, sourceLength, in, inLen);
+  clampRange(target, targetOffset, targetLength, out, outCap);
+
+  size_t total = inLen / 8;
+  size_t count = 0;
+  size_t j = 0;
+  for (; count < total; count++) {
+    uint64_t value = loadVarint(in + count * 8, varintKind, bigint);
+    if (value < 0x80 && j < outCap) {
+      out[j++] = static_cast<uint8_t>(value);
+      continue;
+    }
+    // Stop before a value that does not fit completely
+    size_t len = 1;
+    for (uint64_t v = value >> 7; v != 0; v >>= 7)
+      len++;
+    if (j + len > outCap)
+      break;
+    while (value >= 0x80) {
+      out[j++] = static_cast<uint8_t>(value | 0x80);
+      value >>= 7;
+    }
+    out[j++] = static_cast<uint8_t>(value);
+  }
+  return VarintResult(static_cast<double>(count), static_cast<double>(j));
+}
+
+// ============== Bitwise operations ==============
+// In-place kernels for ranges, e.g. WebSocket frame (un)masking.
+
+// Longest repeating pattern we expand for the vector path. A WebSocket mask
+// (4 bytes) expands to 16 bytes; keys up to 64 bytes always fit.
+static const size_t MAX_XOR_PATTERN = 1024;
+
+void HybridNitroBuffer::xorMask(const std::shared_ptr<ArrayBuffer> &buffer,
+                                double offset, double length,
+                                const std::shared_ptr<ArrayBuffer> &key,
+                                double keyOffset, double keyLength,
+                                double keyPhase) {
+  uint8_t *data = nullptr;
+  size_t len = 0;
+  uint8_t *keyData = nullptr;
+  size_t keyLen = 0;
+  clampRange(buffer, offset, length, data, len);
+  clampRange(key, keyOffset, keyLength, keyData, keyLen);
+  if (len == 0 || keyLen == 0)
+    return;
+  if (!std::isfinite(keyPhase))
+    throw std::invalid_argument("keyPhase must be a finite number");
+  // Normalize into [0, keyLen) before converting: casting a negative double
+  // to size_t is undefined.
+  double wrapped = std::fmod(std::trunc(keyPhase), static_cast<double>(keyLen));
+  if (wrapped < 0)
+    wrapped += static_cast<double>(keyLen);
+  size_t phase = static_cast<size_t>(wrapped);
+
+  // Expand the key (rotated by phase) to a multiple of 16 bytes:
+  // lcm(keyLen, 16) = keyLen * 16 / gcd(keyLen, 16).
+  // (gcd with a power of two is the lowest set bit, capped at 16)
+  size_t gcd = std::min<size_t>(keyLen & (~keyLen + 1), 16);
+  size_t patternLen = keyLen * 16 / gcd;
+  if (patternLen > MAX_XOR_PATTERN) {
+    for (size_t i = 0; i < len; i++) {
+      data[i] ^= keyData[phase++];
+      if (phase == keyLen)
+        phase = 0;
+    }
+    return;
+  }
+
+  uint8_t pattern[MAX_XOR_PATTERN];
+  for (size_t i = 0; i < patternLen; i++) {
+    pattern[i] = keyData[(phase + i) % keyLen];
+  }
+  simd::xorPattern(data, len, pattern, patternLen);
+}
+
+void HybridNitroBuffer::bitwise(const std::shared_ptr<ArrayBuffer> &target,
+                                double targetOffset,
+                                const std::shared_ptr<ArrayBuffer> &source,
+                                double sourceOffset, double length,
+                                const std::string &op) {
+  uint8_t *dst = nullptr;
+  size_t dstLen = 0;
+  uint8_t *src = nullptr;
+  size_t srcLen = 0;
+  clampRange(target, targetOffset, length, dst, dstLen);
+  clampRange(source, sourceOffset, length, src, srcLen);
+  size_t len = std::min(dstLen, srcLen);
+  if (len == 0)
+    return;
+
+  // Overlapping ranges in the same ArrayBuffer: read from a snapshot so the
+  // result is as if the source were read before any write. Compare addresses
+  // as integers: relational operators on pointers into different
+  // ArrayBuffers are unspecified.
+  auto srcAddr = reinterpret_cast<std::uintptr_t>(src);
+  auto dstAddr = reinterpret_cast<std::uintptr_t>(dst);
+  std::vector<uint8_t> snapshot;
+  if (srcAddr < dstAddr + len && dstAddr < srcAddr + len &&
+      srcAddr != dstAddr) {
+    snapshot.assign(src, src + len);
+    src = snapshot.data();
+  }
+
+  if (op == "xor") {
+    simd::bitwiseInPlace<simd::BitwiseOp::Xor>(dst, src, len);
+  } else if (op == "and") {
+    simd::bitwiseInPlace<simd::BitwiseOp::And>(dst, src, len);
+  } else if (op == "or") {
+    simd::bitwiseInPlace<simd::BitwiseOp::Or>(dst, src, len);
+  } else {
+    throw std::invalid_argument("Unknown bitwise operation \"" + op + "\"");
+  }
+}
+
+void HybridNitroBuffer::bitwiseNot(const std::shared_ptr<ArrayBuffer> &buffer,
+                                   double offset, double length) {
+  uint8_t *data = nullptr;
+  size_t len = 0;
+  clampRange(buffer, offset, length, data, len);
+  simd::bitwiseNot(data, len);
 }
 
 double HybridNitroBuffer::compare(const std::shared_ptr<ArrayBuffer> &a,
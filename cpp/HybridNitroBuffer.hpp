@@ -39,6 +39,54 @@ public:
   void fillBuffer(const std::shared_ptr<ArrayBuffer> &buffer,
                   const std::shared_ptr<ArrayBuffer> &value, double offset,
                   double length) override;
+
+  // Encoding conversion
+  std::shared_ptr<ArrayBuffer>
+  transcode(const std::shared_ptr<ArrayBuffer> &source, double sourceOffset,
+            double sourceLength, const std::string &fromEncoding,
+            const std::string &toEncoding) override;
+
+  // Binary-to-binary codecs
+  double base64EncodeInto(const std::shared_ptr<ArrayBuffer> &source,
+                          double sourceOffset, double sourceLength,
+                          const std::shared_ptr<ArrayBuffer> &target,
+                          double targetOffset, double targetLength) override;
+  double base64DecodeInto(const std::shared_ptr<ArrayBuffer> &source,
+                          double sourceOffset, double sourceLength,
+                          const std::shared_ptr<ArrayBuffer> &target,
+                          double targetOffset, double targetLength,
+                          bool lenient) override;
+  double hexEncodeInto(const std::shared_ptr<ArrayBuffer> &source,
+                       double sourceOffset, double sourceLength,
+                       const std::shared_ptr<ArrayBuffer> &target,
+                       double targetOffset, double targetLength) override;
+  double hexDecodeInto(const std::shared_ptr<ArrayBuffer> &source,
+                       double sourceOffset, double sourceLength,
+                       const std::shared_ptr<ArrayBuffer> &target,
+                       double targetOffset, double targetLength,
+                       bool lenient) override;
+
+  // Varint (LEB128) codec
+  VarintResult decodeVarints(const std::shared_ptr<ArrayBuffer> &source,
+                             double sourceOffset, double sourceLength,
+                             const std::shared_ptr<ArrayBuffer> &target,
+                             double targetOffset, double targetLength,
+                             const std::string &kind, bool bigint) override;
+  VarintResult encodeVarints(const std::shared_ptr<ArrayBuffer> &source,
+                             double sourceOffset, double sourceLength,
+                             const std::shared_ptr<ArrayBuffer> &target,
+                             double targetOffset, double targetLength,
+                             const std::string &kind, bool bigint) override;
+
+  // Bitwise operations
+  void xorMask(const std::shared_ptr<ArrayBuffer> &buffer, double offset,
+               double length, const std::shared_ptr<ArrayBuffer> &key,
+               double keyOffset, double keyLength, double keyPhase) override;
+  void bitwise(const std::shared_ptr<ArrayBuffer> &target, double targetOffset,
+               const std::shared_ptr<ArrayBuffer> &source, double sourceOffset,
+               double length, const std::string &op) override;
+  void bitwiseNot(const std::shared_ptr<ArrayBuffer> &buffer, double offset,
+                  double length) override;
 };
 
 } // namespace margelo::nitro::buffer
@@ -0,0 +1,243 @@
+#include "HybridNitroBufferList.hpp"
+#include "NitroBufferEncoding.hpp"
+#include "NitroBufferRange.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace margelo::nitro::buffer {
+
+// ============== Properties ==============
+double HybridNitroBufferList::getLength() {
+  return static_cast<double>(_length);
+}
+
+// ============== Chunk management ==============
+void HybridNitroBufferList::append(const std::shared_ptr<ArrayBuffer> &buffer,
+                                   double offset, double length) {
+  uint8_t *data = nullptr;
+  size_t len = 0;
+  clampRange(buffer, offset, length, data, len);
+  if (len == 0)
+    return;
+
+  _chunks.push_back(Chunk{buffer, static_cast<size_t>(offset), len});
+  _length += len;
+}
+
+void HybridNitroBufferList::consume(double length) {
+  size_t remaining = static_cast<size_t>(length);
+  if (remaining >= _length) {
+    clear();
+    return;
+  }
+
+  _length -= remaining;
+  while (remaining > 0) {
+    Chunk &front = _chunks.front();
+    if (remaining < front.length) {
+      // Partially consumed: just advance the view
+      front.offset += remaining;
+      front.length -= remaining;
+      return;
+    }
+    remaining -= front.length;
+    _chunks.pop_front();
+  }
+}
+
+void HybridNitroBufferList::clear() {
+  _chunks.clear();
+  _length = 0;
+}
+
+// ============== Helpers ==============
+bool HybridNitroBufferList::locate(size_t pos, size_t &chunkIndex,
+                                   size_t &chunkOffset) const {
+  if (pos >= _length)
+    return false;
+  // Most lookups are near the front (parsers consume as they go), so a
+  // linear walk is cheaper than maintaining a prefix-sum index.
+  size_t index = 0;
+  while (pos >= _chunks[index].length) {
+    pos -= _chunks[index].length;
+    index++;
+  }
+  chunkIndex = index;
+  chunkOffset = pos;
+  return true;
+}
+
+bool HybridNitroBufferList::matchesAt(size_t chunkIndex, size_t chunkOffset,
+                                      const uint8_t *needle,
+                                      size_t needleSize) const {
+  size_t matched = 0;
+  while (matched < needleSize) {
+    if (chunkIndex >= _chunks.size())
+      return false;
+    const Chunk &chunk = _chunks[chunkIndex];
+    size_t available = chunk.length - chunkOffset;
+    size_t cmpLen = std::min(available, needleSize - matched);
+    if (memcmp(chunk.data() + chunkOffset, needle + matched, cmpLen) != 0)
+      return false;
+    matched += cmpLen;
+    chunkIndex++;
+    chunkOffset = 0;
+  }
+  return true;
+}
+
+void HybridNitroBufferList::copyRange(size_t start, size_t len,
+                                      uint8_t *dest) const {
+  size_t chunkIndex = 0;
+  size_t chunkOffset = 0;
+  if (len == 0 || !locate(start, chunkIndex, chunkOffset))
+    return;
+
+  size_t copied = 0;
+  while (copied < len) {
+    const Chunk &chunk = _chunks[chunkIndex];
+    size_t copySize = std::min(chunk.length - chunkOffset, len - copied);
+    memcpy(dest + copied, chunk.data() + chunkOffset, copySize);
+    copied += copySize;
+    chunkIndex++;
+    chunkOffset = 0;
+  }
+}
+
+void HybridNitroBufferList::clampIndices(double start, double end,
+                                         size_t &outStart,
+                                         size_t &outEnd) const {
+  size_t s = start > 0 ? static_cast<size_t>(start) : 0;
+  size_t e = end > 0 ? static_cast<size_t>(end) : 0;
+  if (e > _length)
+    e = _length;
+  if (s > e)
+    s = e;
+  outStart = s;
+  outEnd = e;
+}
+
+// ============== Cross-chunk operations ==============
+double HybridNitroBufferList::indexOfByte(double value, double fromIndex) {
+  size_t from = fromIndex > 0 ? static_cast<size_t>(fromIndex) : 0;
+  size_t chunkIndex = 0;
+  size_t chunkOffset = 0;
+  if (!locate(from, chunkIndex, chunkOffset))
+    return -1;
+
+  uint8_t target = static_cast<uint8_t>(value);
+  size_t base = from - chunkOffset; // Absolute position of current chunk
+  for (; chunkIndex < _chunks.size(); chunkIndex++) {
+    const Chunk &chunk = _chunks[chunkIndex];
+    const uint8_t *data = chunk.data();
+    // Use memchr for optimized byte search within each chunk
+    const void *pos =
+        memchr(data + chunkOffset, target, chunk.length - chunkOffset);
+    if (pos != nullptr)
+      return static_cast<double>(base + ((const uint8_t *)pos - data));
+    base += chunk.length;
+    chunkOffset = 0;
+  }
+  return -1;
+}
+
+double
+HybridNitroBufferList::indexOf(const std::shared_ptr<ArrayBuffer> &needle,
+                               double needleOffset, double needleLength,
+                               double fromIndex) {
+  if (needle == nullptr)
+    return -1;
+  size_t needleTotal = needle->size();
+  size_t nStart = static_cast<size_t>(needleOffset);
+  size_t needleSize = static_cast<size_t>(needleLength);
+  if (nStart > needleTotal)
+    nStart = needleTotal;
+  if (nStart + needleSize > needleTotal)
+    needleSize = needleTotal - nStart;
+
+  size_t from = fromIndex > 0 ? static_cast<size_t>(fromIndex) : 0;
+  if (needleSize == 0)
+    return static_cast<double>(std::min(from, _length)); // Empty needle
+  if (from + needleSize > _length)
+    return -1;
+
+  const uint8_t *needleData = needle->data();
+  if (needleData == nullptr)
+    return -1;
+  needleData += nStart;
+  size_t chunkIndex = 0;
+  size_t chunkOffset = 0;
+  locate(from, chunkIndex, chunkOffset);
+
+  // Scan for the first needle byte with memchr, then verify the candidate.
+  // Candidates that straddle a chunk boundary are verified across chunks
+  // without flattening.
+  size_t base = from - chunkOffset;
+  size_t lastStart = _length - needleSize; // Last possible match position
+  for (; chunkIndex < _chunks.size(); chunkIndex++) {
+    const Chunk &chunk = _chunks[chunkIndex];
+    const uint8_t *data = chunk.data();
+    if (base > lastStart)
+      break;
+    size_t scanEnd = std::min(chunk.length, lastStart - base + 1);
+
+    while (chunkOffset < scanEnd) {
+      const void *pos =
+          memchr(data + chunkOffset, needleData[0], scanEnd - chunkOffset);
+      if (pos == nullptr)
+        break;
+      size_t hit = (const uint8_t *)pos - data;
+      bool found;
+      if (hit + needleSize <= chunk.length) {
+        found = memcmp(data + hit, needleData, needleSize) == 0;
+      } else {
+        found = matchesAt(chunkIndex, hit, needleData, needleSize);
+      }
+      if (found)
+        return static_cast<double>(base + hit);
+      chunkOffset = hit + 1;
+    }
+    base += chunk.length;
+    chunkOffset = 0;
+  }
+  return -1;
+}
+
+std::string HybridNitroBufferList::decode(double start, double end,
+                                          const std::string &encoding) {
+  size_t s = 0;
+  size_t e = 0;
+  clampIndices(start, end, s, e);
+  if (s >= e)
+    return "";
+
+  size_t len = e - s;
+  size_t chunkIndex = 0;
+  size_t chunkOffset = 0;
+  locate(s, chunkIndex, chunkOffset);
+
+  // Fast path: range lives in a single chunk, decode in place
+  const Chunk &chunk = _chunks[chunkIndex];
+  if (chunkOffset + len <= chunk.length) {
+    return decodeBytes(chunk.data() + chunkOffset, len, encoding);
+  }
+
+  // Range spans chunks: flatten just the requested bytes
+  std::vector<uint8_t> flat(len);
+  copyRange(s, len, flat.data());
+  return decodeBytes(flat.data(), len, encoding);
+}
+
+std::shared_ptr<ArrayBuffer> HybridNitroBufferList::slice(double start,
+                                                          double end) {
+  size_t s = 0;
+  size_t e = 0;
+  clampIndices(start, end, s, e);
+
+  auto result = ArrayBuffer::allocate(e - s);
+  copyRange(s, e - s, result->data());
+  return result;
+}
+
+} // namespace margelo::nitro::buffer
@@ -0,0 +1,67 @@
+#pragma once
+#include "HybridNitroBufferListSpec.hpp"
+#include <NitroModules/ArrayBuffer.hpp>
+#include <deque>
+#include <stdexcept>
+
+namespace margelo::nitro::buffer {
+
+class HybridNitroBufferList : public HybridNitroBufferListSpec {
+public:
+  HybridNitroBufferList() : HybridObject(TAG), HybridNitroBufferListSpec() {}
+
+  // Properties
+  double getLength() override;
+
+  // Chunk management
+  void append(const std::shared_ptr<ArrayBuffer> &buffer, double offset,
+              double length) override;
+  void consume(double length) override;
+  void clear() override;
+
+  // Cross-chunk operations
+  double indexOfByte(double value, double fromIndex) override;
+  double indexOf(const std::shared_ptr<ArrayBuffer> &needle,
+                 double needleOffset, double needleLength,
+                 double fromIndex) override;
+  std::string decode(double start, double end,
+                     const std::string &encoding) override;
+  std::shared_ptr<ArrayBuffer> slice(double start, double end) override;
+
+private:
+  // A view into an ArrayBuffer owned by JS. We keep a reference so the
+  // memory stays alive, but never copy the bytes.
+  struct Chunk {
+    std::shared_ptr<ArrayBuffer> buffer;
+    size_t offset;
+    size_t length;
+
+    // The ArrayBuffer may have been detached or released by JS since
+    // append(), so re-check it instead of reading through a stale view.
+    inline uint8_t *data() const {
+      uint8_t *base = buffer->data();
+      if (base == nullptr || buffer->size() < offset + length)
+        throw std::runtime_error(
+            "BufferList chunk was detached or released after append()");
+      return base + offset;
+    }
+  };
+
+  // Find the chunk containing absolute position `pos`.
+  // Returns false if `pos` is past the end of the list.
+  bool locate(size_t pos, size_t &chunkIndex, size_t &chunkOffset) const;
+  // Check whether `needle` matches starting at the given chunk position,
+  // following the match into subsequent chunks as needed.
+  bool matchesAt(size_t chunkIndex, size_t chunkOffset, const uint8_t *needle,
+                 size_t needleSize) const;
+  // Copy the absolute range [start, start + len) into `dest`.
+  void copyRange(size_t start, size_t len, uint8_t *dest) const;
+  // Clamp a JS-provided [start, end) pair to the current length.
+  void clampIndices(double start, double end, size_t &outStart,
+                    size_t &outEnd) const;
+
+  std::deque<Chunk> _chunks;
+  size_t _length = 0;
+};
+
+} // namespace margelo::nitro::buffer
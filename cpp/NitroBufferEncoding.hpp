@@ -0,0 +1,14 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace margelo::nitro::buffer {
+
+// Decode raw bytes into a UTF-8 std::string using a Node.js encoding name
+// (utf8, latin1/binary, ascii, hex, base64). Unknown encodings fall back to
+// UTF-8 with replacement characters, matching HybridNitroBuffer::decode.
+std::string decodeBytes(const uint8_t *data, size_t len,
+                        const std::string &encoding);
+
+} // namespace margelo::nitro::buffer
@@ -0,0 +1,30 @@
+#pragma once
+#include <NitroModules/ArrayBuffer.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::buffer {
+
+// Clamp a JS-provided (offset, length) pair to the buffer bounds.
+// On return `data` points at the start of the range (nullptr if the range
+// is empty or the buffer is missing/detached) and `len` is the clamped
+// length.
+inline void clampRange(const std::shared_ptr<ArrayBuffer> &buffer,
+                       double offset, double length, uint8_t *&data,
+                       size_t &len) {
+  data = nullptr;
+  len = 0;
+  if (buffer == nullptr)
+    return;
+  uint8_t *base = buffer->data();
+  size_t totalSize = buffer->size();
+  size_t start = static_cast<size_t>(offset);
+  if (base == nullptr || start >= totalSize)
+    return;
+  len = static_cast<size_t>(length);
+  if (start + len > totalSize)
+    len = totalSize - start;
+  data = base + start;
+}
+
+} // namespace margelo::nitro::buffer
@@ -0,0 +1,259 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Pick the widest vector ISA that is always available on the target ABI:
+// NEON on arm64 (iOS devices, Android arm64-v8a) and SSE2 on x86-64
+// (simulators, Android x86_64). Other ABIs use the portable scalar paths.
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define NITRO_BUFFER_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define NITRO_BUFFER_SSE2 1
+#endif
+
+namespace margelo::nitro::buffer::simd {
+
+// Number of leading bytes in [data, data + len) that are ASCII (< 0x80).
+inline size_t asciiPrefixLength(const uint8_t *data, size_t len) {
+  size_t i = 0;
+#if defined(NITRO_BUFFER_NEON)
+  for (; i + 16 <= len; i += 16) {
+    if (vmaxvq_u8(vld1q_u8(data + i)) >= 0x80)
+      break;
+  }
+#elif defined(NITRO_BUFFER_SSE2)
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    int mask = _mm_movemask_epi8(v);
+    if (mask != 0)
+      return i + __builtin_ctz(mask);
+  }
+#endif
+  for (; i + 8 <= len; i += 8) {
+    uint64_t word;
+    memcpy(&word, data + i, 8);
+    if (word & 0x8080808080808080ULL)
+      break;
+  }
+  while (i < len && data[i] < 0x80)
+    i++;
+  return i;
+}
+
+// Number of leading UTF-16LE code units in `data` (`units` units long) that
+// are ASCII (< 0x80).
+inline size_t asciiUnitPrefixLength(const uint8_t *data, size_t units) {
+  size_t i = 0;
+#if defined(NITRO_BUFFER_NEON)
+  for (; i + 8 <= units; i += 8) {
+    uint16x8_t v = vreinterpretq_u16_u8(vld1q_u8(data + i * 2));
+    if (vmaxvq_u16(v) >= 0x80)
+      break;
+  }
+#elif defined(NITRO_BUFFER_SSE2)
+  const __m128i highBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 8 <= units; i += 8) {
+    __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i * 2));
+    __m128i isAscii = _mm_cmpeq_epi16(_mm_and_si128(v, highBits), zero);
+    if (_mm_movemask_epi8(isAscii) != 0xFFFF)
+      break;
+  }
+#endif
+  while (i < units && data[i * 2 + 1] == 0 && data[i * 2] < 0x80)
+    i++;
+  return i;
+}
+
+// Widen `len` bytes into UTF-16LE code units (latin1 -> UTF-16LE).
+// `dst` must have room for 2 * len bytes.
+inline void widenBytes(const uint8_t *src, size_t len, uint8_t *dst) {
+  size_t i = 0;
+#if defined(NITRO_BUFFER_NEON)
+  const uint8x16_t zero = vdupq_n_u8(0);
+  for (; i + 16 <= len; i += 16) {
+    uint8x16x2_t pair = {{vld1q_u8(src + i), zero}};
+    vst2q_u8(dst + i * 2, pair);
+  }
+#elif defined(NITRO_BUFFER_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2),
+                     _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2 + 16),
+                     _mm_unpackhi_epi8(v, zero));
+  }
+#endif
+  for (; i < len; i++) {
+    dst[i * 2] = src[i];
+    dst[i * 2 + 1] = 0;
+  }
+}
+
+// Narrow `units` UTF-16LE code units into bytes, keeping the low byte.
+// Callers must ensure every unit is < 0x100 (e.g. via asciiUnitPrefixLength).
+inline void narrowUnits(const uint8_t *src, size_t units, uint8_t *dst) {
+  size_t i = 0;
+#if defined(NITRO_BUFFER_NEON)
+  for (; i + 16 <= units; i += 16) {
+    uint8x16x2_t pair = vld2q_u8(src + i * 2);
+    vst1q_u8(dst + i, pair.val[0]);
+  }
+#elif defined(NITRO_BUFFER_SSE2)
+  for (; i + 16 <= units; i += 16) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2));
+    __m128i b =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2 + 16));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i),
+                     _mm_packus_epi16(a, b));
+  }
+#endif
+  for (; i < units; i++) {
+    dst[i] = src[i * 2];
+  }
+}
+
+// Encode `len` bytes as lowercase hex into `dst` (2 * len bytes).
+inline void hexEncode(const uint8_t *src, size_t len, uint8_t *dst) {
+  static const char hexDigits[] = "0123456789abcdef";
+  size_t i = 0;
+#if defined(NITRO_BUFFER_NEON)
+  const uint8x16_t table =
+      vld1q_u8(reinterpret_cast<const uint8_t *>(hexDigits));
+  const uint8x16_t lowMask = vdupq_n_u8(0x0F);
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t v = vld1q_u8(src + i);
+    uint8x16x2_t digits = {{vqtbl1q_u8(table, vshrq_n_u8(v, 4)),
+                            vqtbl1q_u8(table, vandq_u8(v, lowMask))}};
+    vst2q_u8(dst + i * 2, digits);
+  }
+#elif defined(NITRO_BUFFER_SSE2)
+  // No byte shuffle in SSE2, so map nibbles arithmetically:
+  // '0' + n, plus ('a' - '0' - 10) when n > 9.
+  const __m128i lowMask = _mm_set1_epi8(0x0F);
+  const __m128i nine = _mm_set1_epi8(9);
+  const __m128i zeroChar = _mm_set1_epi8('0');
+  const __m128i letterGap = _mm_set1_epi8('a' - '0' - 10);
+  auto toChars = [&](__m128i nibbles) {
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, nine), letterGap);
+    return _mm_add_epi8(_mm_add_epi8(nibbles, zeroChar), letters);
+  };
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    __m128i high = _mm_and_si128(_mm_srli_epi16(v, 4), lowMask);
+    __m128i low = _mm_and_si128(v, lowMask);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2),
+                     toChars(_mm_unpacklo_epi8(high, low)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2 + 16),
+                     toChars(_mm_unpackhi_epi8(high, low)));
+  }
+#endif
+  for (; i < len; i++) {
+    dst[i * 2] = hexDigits[src[i] >> 4];
+    dst[i * 2 + 1] = hexDigits[src[i] & 0x0F];
+  }
+}
+
+enum class BitwiseOp { Xor, And, Or };
+
+template <BitwiseOp Op> inline uint8_t applyBitwise(uint8_t a, uint8_t b) {
+  if constexpr (Op == BitwiseOp::Xor)
+    return a ^ b;
+  else if constexpr (Op == BitwiseOp::And)
+    return a & b;
+  else
+    return a | b;
+}
+
+// dst[i] = dst[i] op src[i]. The ranges must not overlap.
+template <BitwiseOp Op>
+inline void bitwiseInPlace(uint8_t *dst, const uint8_t *src, size_t len) {
+  size_t i = 0;
+#if defined(NITRO_BUFFER_NEON)
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t a = vld1q_u8(dst + i);
+    uint8x16_t b = vld1q_u8(src + i);
+    uint8x16_t r;
+    if constexpr (Op == BitwiseOp::Xor)
+      r = veorq_u8(a, b);
+    else if constexpr (Op == BitwiseOp::And)
+      r = vandq_u8(a, b);
+    else
+      r = vorrq_u8(a, b);
+    vst1q_u8(dst + i, r);
+  }
+#elif defined(NITRO_BUFFER_SSE2)
+  for (; i + 16 <= len; i += 16) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    __m128i r;
+    if constexpr (Op == BitwiseOp::Xor)
+      r = _mm_xor_si128(a, b);
+    else if constexpr (Op == BitwiseOp::And)
+      r = _mm_and_si128(a, b);
+    else
+      r = _mm_or_si128(a, b);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), r);
+  }
+#endif
+  for (; i < len; i++) {
+    dst[i] = applyBitwise<Op>(dst[i], src[i]);
+  }
+}
+
+// data[i] = ~data[i]
+inline void bitwiseNot(uint8_t *data, size_t len) {
+  size_t i = 0;
+#if defined(NITRO_BUFFER_NEON)
+  for (; i + 16 <= len; i += 16) {
+    vst1q_u8(data + i, vmvnq_u8(vld1q_u8(data + i)));
+  }
+#elif defined(NITRO_BUFFER_SSE2)
+  const __m128i ones = _mm_set1_epi8(static_cast<char>(0xFF));
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(data + i),
+                     _mm_xor_si128(v, ones));
+  }
+#endif
+  for (; i < len; i++) {
+    data[i] = static_cast<uint8_t>(~data[i]);
+  }
+}
+
+// XOR `data` with a repeating pattern. `patternLen` must be a multiple of 16
+// so every vector block lines up with a pattern block.
+inline void xorPattern(uint8_t *data, size_t len, const uint8_t *pattern,
+                       size_t patternLen) {
+  size_t i = 0;
+  size_t p = 0; // Position in pattern
+#if defined(NITRO_BUFFER_NEON)
+  for (; i + 16 <= len; i += 16) {
+    vst1q_u8(data + i, veorq_u8(vld1q_u8(data + i), vld1q_u8(pattern + p)));
+    p += 16;
+    if (p == patternLen)
+      p = 0;
+  }
+#elif defined(NITRO_BUFFER_SSE2)
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pattern + p));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(data + i), _mm_xor_si128(v, k));
+    p += 16;
+    if (p == patternLen)
+      p = 0;
+  }
+#endif
+  for (; i < len; i++) {
+    data[i] ^= pattern[p++];
+    if (p == patternLen)
+      p = 0;
+  }
+}
+
+} // namespace margelo::nitro::buffer::simd
@@ -4,7 +4,7 @@ import type { NitroBuffer } from './NitroBuffer.nitro'
 // Lazily load the native module
 let _native: NitroBuffer | undefined
 
-function getNative(): NitroBuffer {
+export function getNative(): NitroBuffer {
     if (!_native) {
         _native = NitroModules.createHybridObject<NitroBuffer>('NitroBuffer')
     }
@@ -299,12 +299,18 @@ export class Buffer extends Uint8Array {
     }
     // ================== Read Methods ==================
 
+    // Single-byte reads index directly: they are hot in parser loops, and a
+    // DataView allocation per call dominates their cost.
     readInt8(offset: number = 0): number {
-        return new DataView(this.buffer, this.byteOffset, this.byteLength).getInt8(offset)
+        const val = this[offset]
+        if (val === undefined) throw new RangeError('Attempt to access memory outside buffer bounds')
+        return (val << 24) >> 24
     }
 
     readUInt8(offset: number = 0): number {
-        return new DataView(this.buffer, this.byteOffset, this.byteLength).getUint8(offset)
+        const val = this[offset]
+        if (val === undefined) throw new RangeError('Attempt to access memory outside buffer bounds')
+        return val
     }
 
     readInt16LE(offset: number = 0): number {
@@ -0,0 +1,86 @@
+import { NitroModules } from 'react-native-nitro-modules'
+import type { NitroBufferList } from './NitroBuffer.nitro'
+import { Buffer } from './Buffer'
+
+/**
+ * A queue of Buffer chunks backed by native memory references.
+ *
+ * Chunks are appended without copying, and search/decode operations work
+ * across chunk boundaries. Only the ranges actually requested by
+ * `toString` or `slice` are flattened, which makes it suitable for
+ * streaming parsers that would otherwise `Buffer.concat` every chunk.
+ *
+ * Note: appended chunks are referenced, not copied. Mutating a chunk after
+ * appending it is visible through the list. Chunks must stay attached while
+ * they are in the list: if a chunk's ArrayBuffer is detached or transferred,
+ * operations that touch it throw instead of reading freed memory.
+ */
+export class BufferList {
+    private _native: NitroBufferList
+
+    constructor(chunks?: Uint8Array[]) {
+        this._native = NitroModules.createHybridObject<NitroBufferList>('NitroBufferList')
+        if (chunks) {
+            for (const chunk of chunks) this.append(chunk)
+        }
+    }
+
+    get length(): number {
+        return this._native.length
+    }
+
+    append(chunk: Uint8Array): this {
+        if (!(chunk instanceof Uint8Array)) throw new TypeError('"chunk" argument must be a Buffer or Uint8Array')
+        if (chunk.length > 0) {
+            this._native.append(chunk.buffer as ArrayBuffer, chunk.byteOffset, chunk.byteLength)
+        }
+        return this
+    }
+
+    consume(bytes: number): void {
+        if (bytes <= 0) return
+        this._native.consume(bytes)
+    }
+
+    clear(): void {
+        this._native.clear()
+    }
+
+    indexOf(value: string | number | Uint8Array, fromIndex: number = 0, encoding?: string): number {
+        if (fromIndex < 0) fromIndex = Math.max(this.length + fromIndex, 0)
+
+        if (typeof value === 'number') {
+            return this._native.indexOfByte(value, fromIndex)
+        }
+        let needle: Uint8Array
+        if (typeof value === 'string') {
+            needle = Buffer.from(value, encoding)
+        } else if (value instanceof Uint8Array) {
+            needle = value
+        } else {
+            throw new TypeError('"value" argument must be string, number or Buffer')
+        }
+        if (needle.length === 1) {
+            return this._native.indexOfByte(needle[0], fromIndex)
+        }
+        return this._native.indexOf(needle.buffer as ArrayBuffer, needle.byteOffset, needle.byteLength, fromIndex)
+    }
+
+    includes(value: string | number | Uint8Array, fromIndex?: number, encoding?: string): boolean {
+        return this.indexOf(value, fromIndex, encoding) !== -1
+    }
+
+    toString(encoding: string = 'utf8', start: number = 0, end: number = this.length): string {
+        if (start < 0) start = 0
+        if (end > this.length) end = this.length
+        if (start >= end) return ''
+        return this._native.decode(start, end, encoding)
+    }
+
+    slice(start: number = 0, end: number = this.length): Buffer {
+        if (start < 0) start = 0
+        if (end > this.length) end = this.length
+        if (start >= end) return Buffer.alloc(0)
+        return new Buffer(this._native.slice(start, end))
+    }
+}
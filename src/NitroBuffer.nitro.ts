@@ -1,5 +1,12 @@
 import { type HybridObject } from 'react-native-nitro-modules'
 
+export interface VarintResult {
+    // Number of values decoded/encoded
+    count: number
+    // Number of varint bytes consumed/produced
+    byteLength: number
+}
+
 export interface NitroBuffer extends HybridObject<{ ios: 'c++', android: 'c++' }> {
     // Allocation
     alloc(size: number): ArrayBuffer
@@ -16,4 +23,41 @@ export interface NitroBuffer extends HybridObject<{ ios: 'c++', android: 'c++' }
     lastIndexOfByte(buffer: ArrayBuffer, value: number, offset: number, length: number): number
     lastIndexOfBuffer(buffer: ArrayBuffer, needle: ArrayBuffer, offset: number, length: number): number
     fillBuffer(buffer: ArrayBuffer, value: ArrayBuffer, offset: number, length: number): void
+
+    // Encoding conversion (utf8, utf16le/ucs2, latin1/binary, ascii)
+    transcode(source: ArrayBuffer, sourceOffset: number, sourceLength: number, fromEncoding: string, toEncoding: string): ArrayBuffer
+
+    // Binary-to-binary codecs (return bytes written, -1 on invalid input)
+    base64EncodeInto(source: ArrayBuffer, sourceOffset: number, sourceLength: number, target: ArrayBuffer, targetOffset: number, targetLength: number): number
+    base64DecodeInto(source: ArrayBuffer, sourceOffset: number, sourceLength: number, target: ArrayBuffer, targetOffset: number, targetLength: number, lenient: boolean): number
+    hexEncodeInto(source: ArrayBuffer, sourceOffset: number, sourceLength: number, target: ArrayBuffer, targetOffset: number, targetLength: number): number
+    hexDecodeInto(source: ArrayBuffer, sourceOffset: number, sourceLength: number, target: ArrayBuffer, targetOffset: number, targetLength: number, lenient: boolean): number
+
+    // Varint (LEB128) codec. Values are 8-byte doubles, or int64 when bigint is true.
+    // kind: 'uint64' | 'int64' | 'sint64' (zigzag)
+    decodeVarints(source: ArrayBuffer, sourceOffset: number, sourceLength: number, target: ArrayBuffer, targetOffset: number, targetLength: number, kind: string, bigint: boolean): VarintResult
+    encodeVarints(source: ArrayBuffer, sourceOffset: number, sourceLength: number, target: ArrayBuffer, targetOffset: number, targetLength: number, kind: string, bigint: boolean): VarintResult
+
+    // Bitwise operations (in place on the target range)
+    // keyPhase: index into the key of the byte applied to buffer[offset]
+    xorMask(buffer: ArrayBuffer, offset: number, length: number, key: ArrayBuffer, keyOffset: number, keyLength: number, keyPhase: number): void
+    // op: 'xor' | 'and' | 'or'
+    bitwise(target: ArrayBuffer, targetOffset: number, source: ArrayBuffer, sourceOffset: number, length: number, op: string): void
+    bitwiseNot(buffer: ArrayBuffer, offset: number, length: number): void
+}
+
+export interface NitroBufferList extends HybridObject<{ ios: 'c++', android: 'c++' }> {
+    // Total number of bytes currently held
+    readonly length: number
+
+    // Chunk management (chunks are referenced, never copied)
+    append(buffer: ArrayBuffer, offset: number, length: number): void
+    consume(length: number): void
+    clear(): void
+
+    // Cross-chunk operations (only the requested range is flattened)
+    indexOfByte(value: number, fromIndex: number): number
+    indexOf(needle: ArrayBuffer, needleOffset: number, needleLength: number, fromIndex: number): number
+    decode(start: number, end: number, encoding: string): string
+    slice(start: number, end: number): ArrayBuffer
 }
@@ -0,0 +1,50 @@
+import { getNative } from './Buffer'
+
+// In-place bitwise kernels backed by native SIMD code. All functions modify
+// `target` (or `data`) and return it.
+
+type BitwiseOp = 'xor' | 'and' | 'or'
+
+// XOR `data` with a repeating `key`, e.g. WebSocket frame (un)masking with a
+// 4-byte mask. `keyOffset` is the index into the key of the byte applied to
+// data[0], so a payload processed in pieces can continue where the previous
+// piece stopped: keyOffset = bytesProcessedSoFar % key.length. Negative
+// offsets wrap around the key; non-integer offsets throw.
+export function xorMask<T extends Uint8Array>(data: T, key: Uint8Array, keyOffset: number = 0): T {
+    if (key.length === 0) throw new RangeError('"key" must not be empty')
+    if (!Number.isInteger(keyOffset)) throw new RangeError('"keyOffset" must be an integer')
+    keyOffset = ((keyOffset % key.length) + key.length) % key.length
+    getNative().xorMask(
+        data.buffer as ArrayBuffer, data.byteOffset, data.byteLength,
+        key.buffer as ArrayBuffer, key.byteOffset, key.byteLength,
+        keyOffset
+    )
+    return data
+}
+
+function bitwise<T extends Uint8Array>(target: T, source: Uint8Array, op: BitwiseOp): T {
+    getNative().bitwise(
+        target.buffer as ArrayBuffer, target.byteOffset,
+        source.buffer as ArrayBuffer, source.byteOffset,
+        Math.min(target.byteLength, source.byteLength), op
+    )
+    return target
+}
+
+// target[i] ^= source[i] over the shorter of the two lengths
+export function bitwiseXor<T extends Uint8Array>(target: T, source: Uint8Array): T {
+    return bitwise(target, source, 'xor')
+}
+
+export function bitwiseAnd<T extends Uint8Array>(target: T, source: Uint8Array): T {
+    return bitwise(target, source, 'and')
+}
+
+export function bitwiseOr<T extends Uint8Array>(target: T, source: Uint8Array): T {
+    return bitwise(target, source, 'or')
+}
+
+export function bitwiseNot<T extends Uint8Array>(target: T): T {
+    getNative().bitwiseNot(target.buffer as ArrayBuffer, target.byteOffset, target.byteLength)
+    return target
+}
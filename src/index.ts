@@ -1,5 +1,8 @@
 export { Buffer } from './Buffer'
+export { BufferList } from './BufferList'
 export * from './utils'
+export * from './varint'
+export * from './bitwise'
 
 export const INSPECT_MAX_BYTES = 50
 export const kMaxLength = 2147483647
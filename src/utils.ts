@@ -1,5 +1,5 @@
 
-import { Buffer } from './Buffer'
+import { Buffer, getNative } from './Buffer'
 
 export function atob(data: string): string {
     if (typeof global.atob === 'function') {
@@ -67,13 +67,97 @@ export function isUtf8(input: Buffer | Uint8Array | ArrayBuffer): boolean {
     return true
 }
 
+// Encodings the native transcoder converts directly, byte-to-byte
+function isNativeTranscodeEncoding(encoding: string): boolean {
+    switch (encoding) {
+        case 'utf8':
+        case 'utf-8':
+        case 'utf16le':
+        case 'ucs2':
+        case 'latin1':
+        case 'binary':
+        case 'ascii':
+            return true
+        default:
+            return false
+    }
+}
+
 export function transcode(source: Uint8Array, fromEnc: string, toEnc: string): Buffer {
     if (!Buffer.isEncoding(fromEnc) || !Buffer.isEncoding(toEnc)) {
         throw new TypeError('Invalid encoding')
     }
+    const from = fromEnc.toLowerCase()
+    const to = toEnc.toLowerCase()
+    if (isNativeTranscodeEncoding(from) && isNativeTranscodeEncoding(to)) {
+        // Fast path: convert natively without a JS string round trip
+        return new Buffer(getNative().transcode(source.buffer as ArrayBuffer, source.byteOffset, source.byteLength, from, to))
+    }
     const buf = source instanceof Buffer ? source : Buffer.from(source)
-    const str = buf.toString(fromEnc)
-    return Buffer.from(str, toEnc)
+    const str = buf.toString(from)
+    return Buffer.from(str, to)
+}
+
+// ================== Binary-to-binary codecs ==================
+// base64/hex text that already lives in a Buffer is converted natively
+// between byte ranges, never materializing a JS string.
+
+export function base64EncodeInto(source: Uint8Array, target: Uint8Array): number {
+    return getNative().base64EncodeInto(
+        source.buffer as ArrayBuffer, source.byteOffset, source.byteLength,
+        target.buffer as ArrayBuffer, target.byteOffset, target.byteLength
+    )
+}
+
+export function base64Encode(source: Uint8Array): Buffer {
+    const target = Buffer.allocUnsafe(4 * Math.ceil(source.byteLength / 3))
+    base64EncodeInto(source, target)
+    return target
+}
+
+// In lenient mode ASCII whitespace (e.g. MIME/PEM line breaks) is skipped.
+export function base64DecodeInto(source: Uint8Array, target: Uint8Array, lenient: boolean = false): number {
+    const written = getNative().base64DecodeInto(
+        source.buffer as ArrayBuffer, source.byteOffset, source.byteLength,
+        target.buffer as ArrayBuffer, target.byteOffset, target.byteLength,
+        lenient
+    )
+    if (written < 0) throw new TypeError('Invalid base64 input')
+    return written
+}
+
+export function base64Decode(source: Uint8Array, lenient: boolean = false): Buffer {
+    // Upper bound: every input byte is a base64 character
+    const target = Buffer.allocUnsafe(Math.floor(source.byteLength / 4) * 3 + 2)
+    return target.subarray(0, base64DecodeInto(source, target, lenient))
+}
+
+export function hexEncodeInto(source: Uint8Array, target: Uint8Array): number {
+    return getNative().hexEncodeInto(
+        source.buffer as ArrayBuffer, source.byteOffset, source.byteLength,
+        target.buffer as ArrayBuffer, target.byteOffset, target.byteLength
+    )
+}
+
+export function hexEncode(source: Uint8Array): Buffer {
+    const target = Buffer.allocUnsafe(source.byteLength * 2)
+    hexEncodeInto(source, target)
+    return target
+}
+
+export function hexDecodeInto(source: Uint8Array, target: Uint8Array, lenient: boolean = false): number {
+    const written = getNative().hexDecodeInto(
+        source.buffer as ArrayBuffer, source.byteOffset, source.byteLength,
+        target.buffer as ArrayBuffer, target.byteOffset, target.byteLength,
+        lenient
+    )
+    if (written < 0) throw new TypeError('Invalid hex input')
+    return written
+}
+
+export function hexDecode(source: Uint8Array, lenient: boolean = false): Buffer {
+    const target = Buffer.allocUnsafe(source.byteLength >>> 1)
+    return target.subarray(0, hexDecodeInto(source, target, lenient))
 }
 
 export function resolveObjectURL(id: string): string | undefined {
@@ -0,0 +1,114 @@
+import { Buffer, getNative } from './Buffer'
+
+// Protobuf-style varint (LEB128) helpers backed by the native bulk codec.
+//
+// Kinds follow protobuf naming:
+//   'uint64' - unsigned (uint32/uint64 fields)
+//   'int64'  - two's complement, negative values take 10 bytes (int32/int64)
+//   'sint64' - zigzag encoded (sint32/sint64)
+//
+// Values outside ±2^53 lose precision as numbers; use the BigInt variants
+// for full 64-bit fields.
+
+export type VarintKind = 'uint64' | 'int64' | 'sint64'
+
+export interface VarintDecodeResult<T> {
+    values: T
+    bytesRead: number
+}
+
+type VarintValues = Float64Array | BigInt64Array | BigUint64Array
+
+export function decodeVarintsInto(source: Uint8Array, target: VarintValues, kind: VarintKind = 'uint64'): { count: number, bytesRead: number } {
+    const result = getNative().decodeVarints(
+        source.buffer as ArrayBuffer, source.byteOffset, source.byteLength,
+        target.buffer as ArrayBuffer, target.byteOffset, target.byteLength,
+        kind, !(target instanceof Float64Array)
+    )
+    return { count: result.count, bytesRead: result.byteLength }
+}
+
+// Decodes every complete varint in `source` (up to `maxCount`). `bytesRead`
+// stops before a truncated trailing varint, so streaming callers can keep
+// the remainder for the next chunk. Malformed input (a varint longer than
+// 10 bytes or overflowing 64 bits) throws instead, since no further data
+// could complete it.
+export function decodeVarints(source: Uint8Array, kind: VarintKind = 'uint64', maxCount: number = source.byteLength): VarintDecodeResult<Float64Array> {
+    const values = new Float64Array(Math.min(maxCount, source.byteLength))
+    const { count, bytesRead } = decodeVarintsInto(source, values, kind)
+    return { values: count === values.length ? values : values.slice(0, count), bytesRead }
+}
+
+export function decodeBigVarints(source: Uint8Array, kind: VarintKind = 'uint64', maxCount: number = source.byteLength): VarintDecodeResult<BigInt64Array | BigUint64Array> {
+    const length = Math.min(maxCount, source.byteLength)
+    const values = kind === 'uint64' ? new BigUint64Array(length) : new BigInt64Array(length)
+    const { count, bytesRead } = decodeVarintsInto(source, values, kind)
+    return { values: count === values.length ? values : values.slice(0, count), bytesRead }
+}
+
+export function encodeVarintsInto(values: VarintValues, target: Uint8Array, kind: VarintKind = 'uint64'): { count: number, bytesWritten: number } {
+    const result = getNative().encodeVarints(
+        values.buffer as ArrayBuffer, values.byteOffset, values.byteLength,
+        target.buffer as ArrayBuffer, target.byteOffset, target.byteLength,
+        kind, !(values instanceof Float64Array)
+    )
+    return { count: result.count, bytesWritten: result.byteLength }
+}
+
+export function encodeVarints(values: ArrayLike<number> | VarintValues, kind: VarintKind = 'uint64'): Buffer {
+    const source = values instanceof Float64Array || values instanceof BigInt64Array || values instanceof BigUint64Array
+        ? values
+        : Float64Array.from(values as ArrayLike<number>)
+    // A 64-bit varint takes at most 10 bytes
+    const target = Buffer.allocUnsafe(source.length * 10)
+    const { bytesWritten } = encodeVarintsInto(source, target, kind)
+    return Buffer.from(target.subarray(0, bytesWritten))
+}
+
+// ================== Zigzag ==================
+
+export function zigzagEncode32(value: number): number {
+    return ((value << 1) ^ (value >> 31)) >>> 0
+}
+
+export function zigzagDecode32(value: number): number {
+    return (value >>> 1) ^ -(value & 1)
+}
+
+export function zigzagEncode64(value: bigint): bigint {
+    return BigInt.asUintN(64, (value << 1n) ^ (value >> 63n))
+}
+
+export function zigzagDecode64(value: bigint): bigint {
+    return BigInt.asIntN(64, (value >> 1n) ^ -(value & 1n))
+}
+
+// ================== Fixed32 / Fixed64 ==================
+// Packed fixed-width fields are little-endian, like every platform React
+// Native runs on, so these are plain copies that also fix alignment.
+
+export function decodeFixed32(source: Uint8Array, signed: boolean = false): Uint32Array | Int32Array {
+    const count = source.byteLength >>> 2
+    const values = signed ? new Int32Array(count) : new Uint32Array(count)
+    new Uint8Array(values.buffer).set(source.subarray(0, count * 4))
+    return values
+}
+
+export function decodeFixed64(source: Uint8Array, signed: boolean = false): BigUint64Array | BigInt64Array {
+    const count = source.byteLength >>> 3
+    const values = signed ? new BigInt64Array(count) : new BigUint64Array(count)
+    new Uint8Array(values.buffer).set(source.subarray(0, count * 8))
+    return values
+}
+
+export function encodeFixed32(values: ArrayLike<number> | Uint32Array | Int32Array): Buffer {
+    const source = values instanceof Uint32Array || values instanceof Int32Array
+        ? values
+        : Uint32Array.from(values, (v) => v >>> 0)
+    return Buffer.from(new Uint8Array(source.buffer, source.byteOffset, source.byteLength))
+}
+
+export function encodeFixed64(values: BigUint64Array | BigInt64Array | bigint[]): Buffer {
+    const source = Array.isArray(values) ? BigUint64Array.from(values, (v) => BigInt.asUintN(64, v)) : values
+    return Buffer.from(new Uint8Array(source.buffer, source.byteOffset, source.byteLength))
+}